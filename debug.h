@@ -38,6 +38,17 @@
 #endif
 
 
+// STATS_DETAIL adds the statistics that cost something on every merger:
+// the histograms and the time spent renormalizing
+#ifdef STATS_DETAIL
+    #ifndef STATS_TRACING
+    #define STATS_TRACING
+    #endif
+    #define DETAIL_STATS(expr)	expr
+#else
+    #define DETAIL_STATS(expr)
+#endif
+
 #ifdef STATS_TRACING
     #define STATS(expr)	expr
 #else
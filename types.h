@@ -12,11 +12,28 @@ const int MAXINT = 2147483647;		// 2^31 - 1
 typedef int  FlowAmount;
 typedef FlowAmount NodeExcess;
 
+// the statistics counters can pass 2^31 on large instances
+typedef long long StatCount;
+const StatCount MAX_STAT_COUNT = 0x7fffffffffffffffLL;
+
 class Node;
 typedef Node* NodePtr;
 class Edge;
 typedef Edge* EdgePtr;
 
+#ifdef COMPACT_GRAPH
+// With the compact layout, edges and edge lists hold 32-bit indices into
+// the solver's node and edge arrays.  Each thread that touches a graph
+// binds that graph's arrays here (see PhaseSolver::bindGraph).
+typedef int EdgeId;
+struct GraphBase {
+    static __thread NodePtr nodes;
+    static __thread EdgePtr edges;
+};
+inline EdgePtr edgeAt(EdgeId id);		// defined in Edge.h
+inline EdgeId edgeIndex(EdgePtr edgep);		// defined in Edge.h
+#endif /*COMPACT_GRAPH*/
+
 inline int min(int x, int y) { return (x < y) ? x : y; }
 inline int max(int x, int y) { return (x > y) ? x : y; }
 inline int iabs(int x) { return (x < 0) ? -x : x; }